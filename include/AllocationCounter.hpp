@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+////////////////////////////////////////
+// Heap allocation counting for debug and bench builds. When
+// JUMPGAME_COUNT_ALLOCATIONS is defined global operator new is replaced
+// and counts allocations made by each thread. NoAllocationScope aborts
+// if any allocation happened on the calling thread while it was alive.
+// Without the define everything here compiles to nothing.
+namespace allocation {
+
+#ifdef JUMPGAME_COUNT_ALLOCATIONS
+    // number of heap allocations made so far by the calling thread
+    size_t count();
+#else
+    inline size_t count() { return 0; }
+#endif
+
+}
+
+class NoAllocationScope {
+public:
+#ifdef JUMPGAME_COUNT_ALLOCATIONS
+    explicit NoAllocationScope(const char* name);
+    ~NoAllocationScope();
+#else
+    explicit NoAllocationScope(const char*) {}
+#endif
+
+    NoAllocationScope(const NoAllocationScope&) = delete;
+    NoAllocationScope& operator=(const NoAllocationScope&) = delete;
+
+#ifdef JUMPGAME_COUNT_ALLOCATIONS
+private:
+    const char* mName;
+    size_t mStartCount;
+#endif
+};
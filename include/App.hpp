@@ -3,28 +3,37 @@
 #include "Character.hpp"
 #include "PlatformPool.hpp"
 #include "Platform.hpp"
+#include "ParticleSystem.hpp"
+#include "Background.hpp"
+#include "Constants.hpp"
 
 class App {
 public:
-    App(unsigned int width, unsigned int height);
+    App(unsigned int width, unsigned int height, unsigned int tickRate = defaultTickRate);
     
     void processEvents();
     void update(const sf::Time& delta);
     void run();
-    void render();
+    // alpha is fraction of a tick elapsed since last update, used to interpolate between last two states
+    void render(float alpha);
 
     void checkCollisionWithPlatforms();
 
-public:
-    static const sf::Time timePerFrame;
+    // simulation rate in ticks per second, clamped to [minTickRate, maxTickRate]
+    void setTickRate(unsigned int tickRate);
+    const sf::Time& getTimePerTick() const;
 
 
 private:
     unsigned int mWindowWidth;
     unsigned int mWindowHeight;
+    sf::Time mTimePerTick;
+    // pixels per second
     sf::Vector2f mCameraSpeed;
     sf::RenderWindow mWindow;
     std::shared_ptr<Character> actor;
     PlatformPool mPlatformPool;
     Camera2D mCamera;
+    ParticleSystem mParticles;
+    Background mBackground;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Camera.hpp"
+
+#include <memory>
+#include <vector>
+
+enum class LayerStyle { Stars, Clouds, Islands };
+
+////////////////////////////////////////
+// One parallax layer. Layer is cut into horizontal strips of
+// backgroundStripHeight. Each strip is composited once from tiles into
+// an off-screen texture when it comes into view and is evicted when it
+// goes below the screen. Strips live in a fixed ring whose textures and
+// shapes are created once, so streaming doesn't allocate.
+class ParallaxLayer {
+public:
+    // factor 0 means layer doesn't move, 1 means layer moves with camera
+    ParallaxLayer(float factor, const sf::Color& clearColor, LayerStyle style);
+
+    // cameraPos is the (interpolated) camera position used for this frame
+    void update(const sf::Vector2f& cameraPos);
+    void draw(sf::RenderTarget& target, const sf::Vector2f& cameraPos);
+
+private:
+    struct Strip {
+        int index; // strip covers layer y in [index * height, (index + 1) * height)
+        std::unique_ptr<sf::RenderTexture> texture;
+        sf::Sprite sprite;
+    };
+
+    // k-th live strip from the top
+    Strip& strip(size_t k);
+    void composeStrip(sf::RenderTexture& texture);
+
+private:
+    float mFactor;
+    sf::Color mClearColor;
+    LayerStyle mStyle;
+    // ring of backgroundStripsPerLayer strips, live ones go from mFirst (top) to mFirst + mCount (bottom)
+    std::vector<Strip> mStrips;
+    size_t mFirst;
+    size_t mCount;
+    // reused for every tile, so composing doesn't create shapes
+    sf::CircleShape mStar;
+    sf::CircleShape mPuff;
+    sf::ConvexShape mIsland;
+};
+
+class Background {
+public:
+    Background();
+
+    void update(Camera2D& camera, float alpha);
+    void draw(sf::RenderTarget& target, Camera2D& camera, float alpha);
+
+private:
+    // far to near
+    std::vector<std::unique_ptr<ParallaxLayer>> mLayers;
+};
@@ -6,10 +6,14 @@ class Camera2D {
     public:
         Camera2D();
 
-        sf::Transform& getTransform();
         void moveBy(sf::Vector2f& delta);
         sf::Vector2f& getPosition();
+
+        // alpha is how far render time is between previous tick (0) and current tick (1)
+        sf::Vector2f getInterpolatedPosition(float alpha) const;
+        sf::Transform getInterpolatedTransform(float alpha) const;
     private:
         sf::Vector2f mPos;
-        sf::Transform mTransform;
+        // position before last moveBy, used for interpolated rendering
+        sf::Vector2f mPrevPos;
 };
\ No newline at end of file
@@ -2,8 +2,11 @@
 
 #include "Camera.hpp"
 #include "Platform.hpp"
+#include "ParticleSystem.hpp"
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 enum class Direction { Left, Right};
 enum class Movement { Idle, Run, Jump, Fall};
@@ -12,7 +15,7 @@ class Animation {
 public:
     Animation();
 
-    void setup(std::string name, int x, int y, int width, int height, int numFrames) ;
+    void setup(const std::string& name, int x, int y, int width, int height, int numFrames) ;
     void update(sf::Time delta);
     void step();
     void applyTexture(sf::Sprite& sp, Direction dir) ;
@@ -32,13 +35,14 @@ private:
 
 class Character {
 public:
-    Character(const sf::Vector2f& pos, Platform* p);
+    Character(const sf::Vector2f& pos, Platform* p, ParticleSystem* particles);
 
     void update(const sf::Time& delta);
-    void draw(sf::RenderTarget& window, Camera2D& camera);
+    void draw(sf::RenderTarget& window, Camera2D& camera, float alpha);
     
     bool checkCollision(Platform* p);
     void updateRestingPlatform(Platform* p);
+    Platform* getRestingPlatform() const;
     bool shouldCheckForCollision();
 
     bool outOfGame(Camera2D& camera);
@@ -49,6 +53,8 @@ public:
 
 private:
     sf::Sprite mSprite;
+    // sprite position at start of last update, used for interpolated rendering and swept collision
+    sf::Vector2f mPrevPosition;
     // Row represent movement and column direction. So [Run][Left] or [Run][Right]
     Animation mTextures[4][2];
     Direction mDirection;
@@ -59,6 +65,11 @@ private:
     //owned by platformPool
     Platform* mRestingPlatform;
 
+    //owned by App
+    ParticleSystem* mParticles;
+    // fractional trail particles carried over to next update
+    float mTrailAccumulator;
+
     // When the up arrow is pressed how much vertical velocity to give
     sf::Vector2f jumpInitialVelocity; 
     bool isJumping;
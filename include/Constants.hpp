@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <random>
 
 namespace  {
@@ -8,6 +9,10 @@ namespace  {
     
     inline static const unsigned int screenWidth = 800;
     inline static const unsigned int screenHeight = 600;
+    inline static const unsigned int defaultTickRate = 60;
+    // landing uses a swept check (Character::checkCollision), so large fall steps at low rates don't tunnel
+    inline static const unsigned int minTickRate = 20;
+    inline static const unsigned int maxTickRate = 480;
     inline static float pixelPerMeter = 100.0f; // this represent how many pixel 1 meter of real worl represent. so vel = 2m/s will be 200 pixel/sec and acceleration of 9.8 m/s2 will 9800 pixel/s2
     
     inline static float platformHeight = 10.0f;
@@ -19,6 +24,19 @@ namespace  {
 
     inline static float jumpYSpeed = -8.0f; //-8m/s
     inline static float jumpXSpeed = 2.2f;
+
+    inline static const size_t particleCapacity = 32768;
+    inline static float particleSize = 3.0f;
+    inline static float particleGravity = 4.0f; // 4m/s2, particles fall slower than character
+    inline static const size_t landingParticles = 40;
+    inline static const size_t jumpParticles = 25;
+    inline static float trailParticlesPerSecond = 120.0f;
+
+    inline static const unsigned int backgroundStripHeight = screenHeight / 2;
+    inline static const unsigned int backgroundTileSize = 50;
+    // a screen can overlap this many strips at most
+    inline static const unsigned int backgroundStripsPerLayer = (screenHeight + backgroundStripHeight - 1) / backgroundStripHeight + 1;
+
     inline float random(int low, int high)
     {
         std::uniform_int_distribution<> dist(low, high);
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Camera.hpp"
+
+#include <vector>
+
+////////////////////////////////////////
+// Fixed capacity particle pool. Particles are stored as
+// structure-of-arrays so the integration step can run 4 particles
+// at a time with SSE. Live particles are always packed in [0, mCount),
+// a dead particle is swapped with the last live one. All storage is
+// allocated once in the constructor, emitting and updating never touch the heap.
+class ParticleSystem {
+public:
+    explicit ParticleSystem(size_t capacity);
+
+    // spawn count particles at pos, velocity is picked randomly inside [minVel, maxVel]
+    void emit(const sf::Vector2f& pos, const sf::Vector2f& minVel, const sf::Vector2f& maxVel,
+              float lifetime, const sf::Color& color, size_t count);
+    void update(const sf::Time& delta);
+    void draw(sf::RenderTarget& target, Camera2D& camera, float alpha);
+
+private:
+    void integrate(float dt);
+    void removeDead();
+    void kill(size_t i);
+
+private:
+    // capacity is the size of the arrays below
+    size_t mCount;
+    // length of last update, previous position is pos - vel * dt so it is not stored
+    float mLastDelta;
+
+    std::vector<float> mPosX;
+    std::vector<float> mPosY;
+    std::vector<float> mVelX;
+    std::vector<float> mVelY;
+    std::vector<float> mLife;
+    std::vector<float> mInvLifetime;
+    std::vector<sf::Color> mColor;
+
+    // 4 vertex per particle, drawn with single draw call as sf::Quads
+    std::vector<sf::Vertex> mVertices;
+};
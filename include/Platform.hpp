@@ -6,8 +6,10 @@
 class Platform {
 public:
     Platform(float width, float y, float x);
+    // reuse platform with new size and position instead of allocating new one
+    void reset(float width, float y, float x);
     void update(const sf::Time& delta);
-    void draw(sf::RenderTarget& target, Camera2D& camera);
+    void draw(sf::RenderTarget& target, Camera2D& camera, float alpha);
     float getPlatformYPosition() const;
     //[LeftX, RightX]
     std::pair<float,float> getPlatformXPosition() const;
@@ -2,21 +2,29 @@
 
 #include "Platform.hpp"
 #include "Constants.hpp"
-#include <deque>
+#include <memory>
+#include <vector>
 
+////////////////////////////////////////
+// Fixed number of platforms ordered from bottom to top.
+// A platform leaving the screen is not destroyed, it is moved
+// to the top and reused, so releasing never allocates.
 class PlatformPool {
 
 public:
     PlatformPool();
     
-    std::deque<std::unique_ptr<Platform>>& getPlatforms();
+    std::vector<std::unique_ptr<Platform>>& getPlatforms();
     void releaseFromFront();
 
 private:
     void createPlatforms();
+    // width and position of next platform placed above the last one
+    void nextPlatformLayout(float& width, float& y, float& x);
 
 private:
     size_t mSize;
-    std::deque<std::unique_ptr<Platform>> platforms;
+    // decides which quarter of screen next platform goes to
+    int mLayoutIndex;
+    std::vector<std::unique_ptr<Platform>> platforms;
 };
-
@@ -0,0 +1,63 @@
+#include "AllocationCounter.hpp"
+
+#ifdef JUMPGAME_COUNT_ALLOCATIONS
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // per thread so allocations from driver or audio threads don't count against the game loop
+    thread_local size_t allocationCount = 0;
+
+    void* countedAlloc(size_t size) {
+        allocationCount++;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+size_t allocation::count() {
+    return allocationCount;
+}
+
+NoAllocationScope::NoAllocationScope(const char* name) :
+    mName(name),
+    mStartCount(allocationCount)
+{}
+
+NoAllocationScope::~NoAllocationScope() {
+    auto allocations = allocationCount - mStartCount;
+    if (allocations != 0) {
+        // printf instead of iostream, so reporting doesn't allocate itself
+        std::fprintf(stderr, "%zu heap allocation(s) during %s\n", allocations, mName);
+        std::abort();
+    }
+}
+
+// Only the non aligned forms are replaced, nothing in the game uses over-aligned types.
+void* operator new(size_t size) {
+    if (auto p = countedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (auto p = countedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+#endif
@@ -1,23 +1,37 @@
 #include "App.hpp"
 #include "Constants.hpp"
+#include "AllocationCounter.hpp"
 
-const sf::Time App::timePerFrame = sf::seconds(1.f / 60.f);
+#include <algorithm>
 
-App::App(unsigned int width, unsigned int height):
+App::App(unsigned int width, unsigned int height, unsigned int tickRate):
     mWindowWidth(width),
     mWindowHeight(height),
+    mTimePerTick(),
     mWindow(sf::VideoMode(width,height), "JumpGame"),
     actor(),
-    mCameraSpeed(0.0f,0.5f), //Camera is moving up with constant speed (Camera speed is alwys inverse of direction where we want to go)
+    mCameraSpeed(0.0f,30.0f), //Camera is moving up with constant speed of 30 pixel/sec (Camera speed is alwys inverse of direction where we want to go)
     mCamera(),
-    mPlatformPool()
+    mPlatformPool(),
+    mParticles(particleCapacity),
+    mBackground()
 {
     auto initialRestingPlatform = mPlatformPool.getPlatforms().front().get();
     auto platformX = initialRestingPlatform->getPlatformXPosition();
     auto x = (float) random((int)platformX.first, (int)platformX.second);
     auto y = initialRestingPlatform->getPlatformYPosition() - 28.0f;
-    actor = std::make_shared<Character>(sf::Vector2f(x,y), initialRestingPlatform);
+    actor = std::make_shared<Character>(sf::Vector2f(x,y), initialRestingPlatform, &mParticles);
 
+    setTickRate(tickRate);
+}
+
+void App::setTickRate(unsigned int tickRate) {
+    tickRate = std::min(std::max(tickRate, minTickRate), maxTickRate);
+    mTimePerTick = sf::seconds(1.f / (float)tickRate);
+}
+
+const sf::Time& App::getTimePerTick() const {
+    return mTimePerTick;
 }
 
 void App::processEvents()  {
@@ -52,36 +66,54 @@ void App::update(const sf::Time& delta) {
     //if actor of game then quit
     if(actor->outOfGame(mCamera)) {
         mWindow.close(); 
+        return;
     }
 
-    //check front of platform pool if it is still in focus
+    // in debug/bench builds abort if a tick touches the heap. Pools, platforms and
+    // particles are all allocated in constructors, so this holds from the first tick
+    NoAllocationScope noAllocation("App::update");
+
+    //check front of platform pool if it is still in focus. Platform actor is resting on
+    //is kept, releasing recycles it to the top and actor would be snapped onto it
     auto& platforms = mPlatformPool.getPlatforms();
-    if(!platforms.empty() && !platforms.front()->checkPlatformStillInFocus(mCamera)) {
+    if(!platforms.empty() && platforms.front().get() != actor->getRestingPlatform() &&
+       !platforms.front()->checkPlatformStillInFocus(mCamera)) {
         mPlatformPool.releaseFromFront();
     }
 
-    //check collision
-    this->checkCollisionWithPlatforms();
-    
     actor->update(delta);
     for(auto& p : mPlatformPool.getPlatforms())
     {
         p->update(delta);
     }
 
-    mCamera.moveBy(mCameraSpeed);
+    //check collision after moving, so landing is snapped in the same tick and the
+    //state rendered (and interpolated towards) never has the actor inside a platform
+    this->checkCollisionWithPlatforms();
+
+    mParticles.update(delta);
+
+    auto cameraDisplacement = mCameraSpeed * delta.asSeconds();
+    mCamera.moveBy(cameraDisplacement);
 }
 
-void App::render() {
+void App::render(float alpha) {
     // clear the window with black color
     mWindow.clear();
 
+    // background is drawn in screen space, each layer applies its own parallax offset.
+    // Strips are only visual, so they are streamed here against the interpolated camera
+    mBackground.update(mCamera, alpha);
+    mBackground.draw(mWindow, mCamera, alpha);
+
     for(auto& p : mPlatformPool.getPlatforms())
     {
-        p->draw(mWindow, mCamera);
+        p->draw(mWindow, mCamera, alpha);
     }
 
-    actor->draw(mWindow, mCamera);
+    mParticles.draw(mWindow, mCamera, alpha);
+
+    actor->draw(mWindow, mCamera, alpha);
     
     // end the current frame
     mWindow.display();
@@ -95,15 +127,15 @@ void App::run() {
     {
         sf::Time loopTime = clock.restart();
         timeSinceLastUpdate += loopTime;
-        // process and update should follow 60FPS
-        while (timeSinceLastUpdate >= timePerFrame) {
-            timeSinceLastUpdate -= timePerFrame;
+        // process and update run at fixed tick rate, render runs as fast as possible
+        while (timeSinceLastUpdate >= mTimePerTick) {
+            timeSinceLastUpdate -= mTimePerTick;
             
             processEvents();
-            update(App::timePerFrame);
+            update(mTimePerTick);
         }
         
-
-        render();
+        // remainder of accumulator tells how far we are into the next tick
+        render(timeSinceLastUpdate / mTimePerTick);
     }
 }
@@ -0,0 +1,149 @@
+#include "Background.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+ParallaxLayer::ParallaxLayer(float factor, const sf::Color& clearColor, LayerStyle style) :
+    mFactor(factor),
+    mClearColor(clearColor),
+    mStyle(style),
+    mStrips(),
+    mFirst(0),
+    mCount(0),
+    mStar(0.0f, 6),
+    mPuff(),
+    mIsland(4)
+{
+    mStrips.reserve(backgroundStripsPerLayer);
+    for (unsigned int i = 0; i < backgroundStripsPerLayer; i++) {
+        auto texture = std::make_unique<sf::RenderTexture>();
+        if (!texture->create(screenWidth, backgroundStripHeight)) {
+            //Handle error
+            std::cout << "Failed to create background strip";
+        }
+        Strip s { 0, std::move(texture), sf::Sprite() };
+        s.sprite.setTexture(s.texture->getTexture(), true);
+        mStrips.push_back(std::move(s));
+    }
+}
+
+ParallaxLayer::Strip& ParallaxLayer::strip(size_t k) {
+    return mStrips[(mFirst + k) % mStrips.size()];
+}
+
+void ParallaxLayer::update(const sf::Vector2f& cameraPos) {
+    const float height = (float)backgroundStripHeight;
+    auto top = -cameraPos.y * mFactor;
+    auto bottom = top + screenHeight;
+    auto first = (int)std::floor(top / height);
+    auto last = (int)std::ceil(bottom / height) - 1;
+
+    // camera only goes up, so strips leave from the back (bottom)
+    while (mCount > 0 && strip(mCount - 1).index > last) {
+        mCount--;
+    }
+
+    // stream in the strips which came into view at the top, reusing the slot above the top one
+    auto next = mCount == 0 ? last : strip(0).index - 1;
+    for (auto i = next; i >= first; i--) {
+        if (mCount == mStrips.size()) {
+            // ring is sized for a screen, can't happen unless constants change. Drop bottom strip
+            mCount--;
+        }
+        mFirst = (mFirst + mStrips.size() - 1) % mStrips.size();
+        mCount++;
+        strip(0).index = i;
+        composeStrip(*strip(0).texture);
+    }
+}
+
+void ParallaxLayer::draw(sf::RenderTarget& target, const sf::Vector2f& cameraPos) {
+    // composing with BlendAlpha into a cleared strip leaves colour already multiplied
+    // by alpha, so the strip must be drawn premultiplied or it gets multiplied twice
+    const sf::RenderStates premultiplied(sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha));
+
+    auto offset = cameraPos.y * mFactor;
+    for (size_t k = 0; k < mCount; k++) {
+        auto& s = strip(k);
+        s.sprite.setPosition(0.0f, s.index * (float)backgroundStripHeight + offset);
+        target.draw(s.sprite, premultiplied);
+    }
+}
+
+////////////////////////////////////////
+// Draw the artwork tile by tile into the strip. This is the
+// only place where the artwork cost is paid, after this strip is
+// a single textured quad.
+void ParallaxLayer::composeStrip(sf::RenderTexture& texture) {
+    texture.clear(mClearColor);
+
+    const int tile = (int)backgroundTileSize;
+    const int stripHeight = (int)backgroundStripHeight;
+    for (int ty = 0; ty < stripHeight; ty += tile) {
+        for (int tx = 0; tx < (int)screenWidth; tx += tile) {
+            switch (mStyle) {
+            case LayerStyle::Stars: {
+                if (random(0, 3) != 0) break;
+                mStar.setRadius(random(1, 2) * 0.75f);
+                mStar.setPosition(tx + random(0, tile - 4), ty + random(0, tile - 4));
+                mStar.setFillColor(sf::Color(255, 255, 255, (sf::Uint8)random(80, 255)));
+                texture.draw(mStar);
+                break;
+            }
+            case LayerStyle::Clouds: {
+                if (random(0, 15) != 0) break;
+                auto radius = random(12, 20);
+                // keep the cloud inside strip, otherwise it will be cut at the seam
+                auto cy = (float)std::min(std::max(ty + tile / 2, (int)radius + 10), stripHeight - (int)radius - 10);
+                mPuff.setRadius(radius);
+                mPuff.setOrigin(radius, radius);
+                mPuff.setFillColor(sf::Color(200, 210, 230, 60));
+                for (int i = 0; i < 3; i++) {
+                    mPuff.setPosition(tx + i * radius, cy - (i == 1 ? radius / 2.0f : 0.0f));
+                    texture.draw(mPuff);
+                }
+                break;
+            }
+            case LayerStyle::Islands: {
+                if (random(0, 24) != 0) break;
+                auto width = random(tile, 3 * tile);
+                auto height = random(10, 20);
+                auto y = (float)std::min(ty, stripHeight - tile);
+                mIsland.setPoint(0, sf::Vector2f(0.0f, 0.0f));
+                mIsland.setPoint(1, sf::Vector2f(width, 0.0f));
+                mIsland.setPoint(2, sf::Vector2f(width * 0.6f, height + 20.0f));
+                mIsland.setPoint(3, sf::Vector2f(width * 0.3f, height + 25.0f));
+                mIsland.setPosition((float)tx, y);
+                mIsland.setFillColor(sf::Color(40, 40, 70, 160));
+                texture.draw(mIsland);
+                break;
+            }
+            }
+        }
+    }
+
+    texture.display();
+}
+
+Background::Background() :
+    mLayers()
+{
+    mLayers.push_back(std::make_unique<ParallaxLayer>(0.1f, sf::Color(10, 10, 35), LayerStyle::Stars));
+    mLayers.push_back(std::make_unique<ParallaxLayer>(0.3f, sf::Color::Transparent, LayerStyle::Clouds));
+    mLayers.push_back(std::make_unique<ParallaxLayer>(0.6f, sf::Color::Transparent, LayerStyle::Islands));
+}
+
+void Background::update(Camera2D& camera, float alpha) {
+    auto cameraPos = camera.getInterpolatedPosition(alpha);
+    for (auto& layer : mLayers) {
+        layer->update(cameraPos);
+    }
+}
+
+void Background::draw(sf::RenderTarget& target, Camera2D& camera, float alpha) {
+    auto cameraPos = camera.getInterpolatedPosition(alpha);
+    for (auto& layer : mLayers) {
+        layer->draw(target, cameraPos);
+    }
+}
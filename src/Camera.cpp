@@ -4,19 +4,26 @@
 #include <iostream>
 
 Camera2D::Camera2D():
-    mTransform(),
-    mPos(0.0f, 0.0f)
+    mPos(0.0f, 0.0f),
+    mPrevPos(0.0f, 0.0f)
     {}
 
 void Camera2D::moveBy(sf::Vector2f &delta) {
+    mPrevPos = mPos;
     mPos += delta;
-    mTransform.translate(delta);
-}
-
-sf::Transform& Camera2D::getTransform() {
-    return mTransform;
 }
 
 sf::Vector2f& Camera2D::getPosition() {
     return mPos;
 }
+
+sf::Vector2f Camera2D::getInterpolatedPosition(float alpha) const {
+    return mPrevPos + (mPos - mPrevPos) * alpha;
+}
+
+sf::Transform Camera2D::getInterpolatedTransform(float alpha) const {
+    // camera transform is just a translation by its position
+    sf::Transform transform;
+    transform.translate(getInterpolatedPosition(alpha));
+    return transform;
+}
@@ -2,14 +2,15 @@
 #include "Camera.hpp"
 #include "Constants.hpp"
 #include "SFML/System/Vector2.hpp"
+#include <algorithm>
 #include <iostream>
-#include <vector>
 #include <limits>
 
 
 namespace {
 
-    bool calculateIntesection(std::vector<sf::Vector2f>& line1, std::vector<sf::Vector2f>& line2) {
+    // line1 and line2 are both 2 points [start, end]
+    bool calculateIntesection(const sf::Vector2f (&line1)[2], const sf::Vector2f (&line2)[2]) {
         auto result = false;
         // Line1 represented as a1x + b1y = c1
         auto& line1pt1 = line1[0];
@@ -54,13 +55,16 @@ const float Character::gravity = 9.8f;
 sf::Time Animation::holdTime = sf::seconds(0.05f);
 
 
-Character::Character(const sf::Vector2f& pos, Platform* p) :
+Character::Character(const sf::Vector2f& pos, Platform* p, ParticleSystem* particles) :
     mSprite(),
+    mPrevPosition(pos),
     mVelocity(0.0f, 0.0f),
     mDisplacement(0.0f,0.0f),
     jumpInitialVelocity(0.0f, 0.0f),
     isJumping(false),
     mRestingPlatform(p),
+    mParticles(particles),
+    mTrailAccumulator(0.0f),
     mTextures(),
     mDirection(Direction::Right),
     mMovement(Movement::Idle)
@@ -90,6 +94,7 @@ Character::Character(const sf::Vector2f& pos, Platform* p) :
 
 void Character::update(const sf::Time& delta)
 {
+    mPrevPosition = mSprite.getPosition();
     mMovement = Movement::Idle;
     // process input
     sf::Vector2f direction = { 0.0, 0.0 };
@@ -108,6 +113,10 @@ void Character::update(const sf::Time& delta)
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) && !isJumping) {
         jumpInitialVelocity = { 0.0f , jumpYSpeed * pixelPerMeter }; // inital up speed on -8m/s
         isJumping = true;
+
+        // burst from the feet going sideways and downwards
+        auto feet = sf::Vector2f(mSprite.getPosition().x, mSprite.getPosition().y + characterHeight/2.0f);
+        mParticles->emit(feet, { -1.5f, 0.0f }, { 1.5f, 1.0f }, 0.4f, sf::Color::White, jumpParticles);
     }
 
     // jump physics
@@ -118,14 +127,17 @@ void Character::update(const sf::Time& delta)
         mDisplacement.y = 0.0f;
         mDisplacement.x = mVelocity.x * delta.asSeconds();
 
+        auto platformX = mRestingPlatform->getPlatformXPosition();
+        auto x = mSprite.getPosition().x;
+
         //check character doesn't leave right side of platform
-        if (mSprite.getPosition().x + mDisplacement.x > mRestingPlatform->getPlatformXPosition().second) {
-            mDisplacement.x = mRestingPlatform->getPlatformXPosition().second - (mSprite.getPosition().x);
+        if (x + mDisplacement.x > platformX.second) {
+            mDisplacement.x = platformX.second - x;
         }
 
         //check character doesn't leave left side of platform
-        if (mSprite.getPosition().x + mDisplacement.x < mRestingPlatform->getPlatformXPosition().first) {
-            mDisplacement.x = mRestingPlatform->getPlatformXPosition().first - (mSprite.getPosition().x);
+        if (x + mDisplacement.x < platformX.first) {
+            mDisplacement.x = platformX.first - x;
         }
     
     } else {
@@ -147,6 +159,15 @@ void Character::update(const sf::Time& delta)
         }
     }
 
+    if(mMovement == Movement::Fall) {
+        mTrailAccumulator += trailParticlesPerSecond * delta.asSeconds();
+        auto count = (size_t)mTrailAccumulator;
+        mTrailAccumulator -= (float)count;
+        mParticles->emit(mSprite.getPosition(), { -0.3f, -1.0f }, { 0.3f, -0.5f }, 0.3f, sf::Color::Cyan, count);
+    } else {
+        mTrailAccumulator = 0.0f;
+    }
+
     mTextures[(int)mMovement][(int)mDirection].update(delta);
     mTextures[(int)mMovement][(int)mDirection].applyTexture(mSprite, mDirection);
     
@@ -155,8 +176,12 @@ void Character::update(const sf::Time& delta)
     
 }
 
-void Character::draw(sf::RenderTarget& window, Camera2D& camera) {
-    window.draw(mSprite, camera.getTransform());
+void Character::draw(sf::RenderTarget& window, Camera2D& camera, float alpha) {
+    // draw sprite at position between last and current tick without moving the sprite itself
+    auto interpolated = mPrevPosition + (mSprite.getPosition() - mPrevPosition) * alpha;
+    auto transform = camera.getInterpolatedTransform(alpha);
+    transform.translate(interpolated - mSprite.getPosition());
+    window.draw(mSprite, transform);
 }
 
 ////////////////////////////////////////
@@ -185,8 +210,8 @@ bool Character::checkCollision(Platform* p) {
     //if (mDisplacement.y > platformHeight) {
     //    //use interpolation to calculate displacement at platform position with x is within x interval of platform
     //    
-    //    std::vector<sf::Vector2f> line1 = { sf::Vector2f(platformX.first, platformYTop), sf::Vector2f(platformX.second, platformYTop) };
-    //    std::vector<sf::Vector2f> line2 = { sf::Vector2f(charXMid, charYBottom), sf::Vector2f(charXMid + mDisplacement.x, charYBottom + mDisplacement.y) };
+    //    sf::Vector2f line1[2] = { sf::Vector2f(platformX.first, platformYTop), sf::Vector2f(platformX.second, platformYTop) };
+    //    sf::Vector2f line2[2] = { sf::Vector2f(charXMid, charYBottom), sf::Vector2f(charXMid + mDisplacement.x, charYBottom + mDisplacement.y) };
     //    result = calculateIntesection(line1, line2);
     //    
     //    return result;
@@ -219,10 +244,17 @@ bool Character::checkCollision(Platform* p) {
 
     auto platformYTop = p->getPlatformYPosition();
     auto platformYBottom = p->getPlatformYPosition() + platformHeight;
-    auto platformXLeft = p->getPlatformXPosition().first;
-    auto platformXRight = p->getPlatformXPosition().second;
+    auto platformX = p->getPlatformXPosition();
+    auto platformXLeft = platformX.first;
+    auto platformXRight = platformX.second;
 
-    if (charYBottom < platformYTop || platformYBottom < charYTop) {
+    // Swept check: at low tick rates one step can be larger than the box above, so the
+    // bottom edge can jump from above the platform to below it between two checks. If the
+    // bottom edge crossed the platform top during the last update it is a collision too
+    auto prevCharYBottom = mPrevPosition.y + (characterHeight/2.0f);
+    auto crossedPlatformTop = prevCharYBottom < platformYTop && platformYTop <= charYBottom;
+
+    if (!crossedPlatformTop && (charYBottom < platformYTop || platformYBottom < charYTop)) {
         return false;
     }
 
@@ -238,7 +270,14 @@ void Character::updateRestingPlatform(Platform* p) {
     isJumping = false;
     jumpInitialVelocity = {0.0f, 0.0f};
     mSprite.setPosition(sf::Vector2f(mSprite.getPosition().x, mRestingPlatform->getPlatformYPosition()- platformOutlineThickness - characterHeight/2.0f - 1/*for padding*/));
-    
+
+    // dust on landing
+    auto feet = sf::Vector2f(mSprite.getPosition().x, mRestingPlatform->getPlatformYPosition());
+    mParticles->emit(feet, { -2.0f, -1.5f }, { 2.0f, -0.2f }, 0.5f, sf::Color(200, 180, 140), landingParticles);
+}
+
+Platform* Character::getRestingPlatform() const {
+    return mRestingPlatform;
 }
 
 bool Character::shouldCheckForCollision() {
@@ -265,12 +304,13 @@ Animation::Animation() :
     currentRunDir(Direction::Right)
 {}
 
-void Animation::setup(std::string name, int x, int y, int width, int height, int numFrames) 
+void Animation::setup(const std::string& name, int x, int y, int width, int height, int numFrames) 
 {
     if (!mTexture.loadFromFile(name)) {
         //Handle error
         std::cout << "Failed to load texture";
     }
+    frames.reserve(numFrames);
     for (int i = 0; i < numFrames; i++) {
         frames.push_back(sf::IntRect(i * width, 0, width, height));
     }
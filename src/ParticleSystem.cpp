@@ -0,0 +1,127 @@
+#include "ParticleSystem.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLE_USE_SSE 1
+#include <emmintrin.h>
+#endif
+
+ParticleSystem::ParticleSystem(size_t capacity) :
+    mCount(0),
+    mLastDelta(0.0f),
+    mPosX(capacity),
+    mPosY(capacity),
+    mVelX(capacity),
+    mVelY(capacity),
+    mLife(capacity),
+    mInvLifetime(capacity),
+    mColor(capacity),
+    mVertices(capacity * 4)
+{}
+
+void ParticleSystem::emit(const sf::Vector2f& pos, const sf::Vector2f& minVel, const sf::Vector2f& maxVel,
+                          float lifetime, const sf::Color& color, size_t count)
+{
+    std::uniform_real_distribution<float> distX(minVel.x, maxVel.x);
+    std::uniform_real_distribution<float> distY(minVel.y, maxVel.y);
+    std::uniform_real_distribution<float> distLife(0.5f * lifetime, lifetime);
+
+    // when pool is full new particles are dropped, old ones are left to die
+    count = std::min(count, mPosX.size() - mCount);
+    for (size_t n = 0; n < count; n++) {
+        auto i = mCount++;
+        mPosX[i] = pos.x;
+        mPosY[i] = pos.y;
+        mVelX[i] = distX(gen) * pixelPerMeter;
+        mVelY[i] = distY(gen) * pixelPerMeter;
+        mLife[i] = distLife(gen);
+        mInvLifetime[i] = 1.0f / mLife[i];
+        mColor[i] = color;
+    }
+}
+
+void ParticleSystem::update(const sf::Time& delta) {
+    mLastDelta = delta.asSeconds();
+    integrate(mLastDelta);
+    removeDead();
+}
+
+void ParticleSystem::integrate(float dt) {
+    const float gravityStep = particleGravity * pixelPerMeter * dt;
+    size_t i = 0;
+
+#ifdef PARTICLE_USE_SSE
+    const __m128 vDt = _mm_set1_ps(dt);
+    const __m128 vGravity = _mm_set1_ps(gravityStep);
+    for (; i + 4 <= mCount; i += 4) {
+        __m128 vx = _mm_loadu_ps(&mVelX[i]);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&mVelY[i]), vGravity);
+        __m128 px = _mm_add_ps(_mm_loadu_ps(&mPosX[i]), _mm_mul_ps(vx, vDt));
+        __m128 py = _mm_add_ps(_mm_loadu_ps(&mPosY[i]), _mm_mul_ps(vy, vDt));
+        __m128 life = _mm_sub_ps(_mm_loadu_ps(&mLife[i]), vDt);
+        _mm_storeu_ps(&mVelY[i], vy);
+        _mm_storeu_ps(&mPosX[i], px);
+        _mm_storeu_ps(&mPosY[i], py);
+        _mm_storeu_ps(&mLife[i], life);
+    }
+#endif
+
+    // remaining particles (or all of them when SSE is not available)
+    for (; i < mCount; i++) {
+        mVelY[i] += gravityStep;
+        mPosX[i] += mVelX[i] * dt;
+        mPosY[i] += mVelY[i] * dt;
+        mLife[i] -= dt;
+    }
+}
+
+void ParticleSystem::removeDead() {
+    size_t i = 0;
+    while (i < mCount) {
+        if (mLife[i] <= 0.0f) {
+            // swapped in particle is not checked yet, so don't advance i
+            kill(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void ParticleSystem::kill(size_t i) {
+    auto last = --mCount;
+    mPosX[i] = mPosX[last];
+    mPosY[i] = mPosY[last];
+    mVelX[i] = mVelX[last];
+    mVelY[i] = mVelY[last];
+    mLife[i] = mLife[last];
+    mInvLifetime[i] = mInvLifetime[last];
+    mColor[i] = mColor[last];
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target, Camera2D& camera, float alpha) {
+    if (mCount == 0) return;
+
+    const float half = particleSize / 2.0f;
+    // step back from current position towards previous one
+    const float back = (1.0f - alpha) * mLastDelta;
+    for (size_t i = 0; i < mCount; i++) {
+        auto color = mColor[i];
+        // fade out as particle gets older
+        color.a = (sf::Uint8)(color.a * std::min(1.0f, mLife[i] * mInvLifetime[i]));
+
+        auto x = mPosX[i] - mVelX[i] * back;
+        auto y = mPosY[i] - mVelY[i] * back;
+        sf::Vertex* quad = &mVertices[i * 4];
+        quad[0].position = sf::Vector2f(x - half, y - half);
+        quad[1].position = sf::Vector2f(x + half, y - half);
+        quad[2].position = sf::Vector2f(x + half, y + half);
+        quad[3].position = sf::Vector2f(x - half, y + half);
+        quad[0].color = color;
+        quad[1].color = color;
+        quad[2].color = color;
+        quad[3].color = color;
+    }
+
+    target.draw(mVertices.data(), mCount * 4, sf::Quads, sf::RenderStates(camera.getInterpolatedTransform(alpha)));
+}
@@ -16,6 +16,12 @@ Platform::Platform(float width, float y, float x) :
     mSprite.setOutlineThickness(platformOutlineThickness);
 }
 
+void Platform::reset(float width, float y, float x) {
+    mSize.x = width;
+    mSprite.setPosition(x, y);
+    mSprite.setSize(mSize);
+}
+
 void Platform::update(const sf::Time& delta) {
     
     sf::Vector2f displacement = mVelocity * delta.asSeconds();
@@ -23,9 +29,9 @@ void Platform::update(const sf::Time& delta) {
 
 }
 
-void Platform::draw(sf::RenderTarget& target, Camera2D& camera) {
+void Platform::draw(sf::RenderTarget& target, Camera2D& camera, float alpha) {
 
-    target.draw(mSprite, camera.getTransform());
+    target.draw(mSprite, camera.getInterpolatedTransform(alpha));
 
 }
 
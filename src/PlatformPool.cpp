@@ -1,11 +1,14 @@
 #include "PlatformPool.hpp"
 #include "Platform.hpp"
-#include <deque>
+#include <algorithm>
 #include <memory>
 
 PlatformPool::PlatformPool() :
-    mSize(20)
+    mSize(20),
+    mLayoutIndex(1)
 {
+    platforms.reserve(mSize);
+
     std::unique_ptr<Platform> p1 = std::make_unique<Platform>(random(100,screenWidth/4), screenHeight-100,random(screenWidth/4, screenWidth/2));
     std::unique_ptr<Platform> p2 = std::make_unique<Platform>(random(100,screenWidth/2), (float)screenHeight/2, random(screenWidth/4, (int)(3*(screenWidth/4.0f)) ));
 
@@ -15,50 +18,58 @@ PlatformPool::PlatformPool() :
     createPlatforms();
 }
     
-std::deque<std::unique_ptr<Platform>>& PlatformPool::getPlatforms() {
+std::vector<std::unique_ptr<Platform>>& PlatformPool::getPlatforms() {
     return platforms;
 }
 
 void PlatformPool::releaseFromFront() {
-    if(!platforms.empty()) {
-        (void)platforms.front().release();
-        platforms.pop_front();
+    if(platforms.size() < 2) {
+        return;
     }
 
-    if(platforms.size() < 10 ) {
-        // if size of platform pool reduce by certain size and they again make the platforms as per size
-        createPlatforms();
-    }
+    // bottom platform becomes the top one
+    std::rotate(platforms.begin(), platforms.begin() + 1, platforms.end());
+
+    float width, y, x;
+    nextPlatformLayout(width, y, x);
+    platforms.back()->reset(width, y, x);
 }
 
 void PlatformPool::createPlatforms() {
-    int i = 1;
     while (platforms.size() < mSize) {
-        auto lastPlatformPosition = platforms.back()->getPlatformYPosition();
-        auto y =  lastPlatformPosition - (float)random(100,300) ;
-        float x;
-        if (i % 4 == 1) {
-            x = random(0, screenWidth/4);
-        }
-        else if (i % 4 == 2) {
-            x = random(screenWidth/4, screenWidth/2);
-        }
-        else if (i % 4 == 3) {
-            x = random(screenWidth/2, (int) (0.625* screenWidth));
-        }
-        else {
-            x = random((int)(0.625 * screenWidth), (int)(0.75 * screenWidth));
-        }
-        float width;
-
-        if (i % 4 == 1 || i % 4 == 3) {
-            width = random(100, screenWidth / 2);
-        }
-        else {
-            width = random(100, screenWidth / 4);
-        }
+        float width, y, x;
+        nextPlatformLayout(width, y, x);
         std::unique_ptr<Platform> p = std::make_unique<Platform>(width,y,x);
         platforms.push_back(std::move(p));
-        i++;
     }
 }
+
+void PlatformPool::nextPlatformLayout(float& width, float& y, float& x) {
+    // last element is the top most platform. While recycling, the top one is
+    // the platform being reset, so the one below it is used
+    auto& last = platforms.size() < mSize ? platforms.back() : platforms[platforms.size() - 2];
+    auto lastPlatformPosition = last->getPlatformYPosition();
+    y =  lastPlatformPosition - (float)random(100,300) ;
+
+    auto i = mLayoutIndex;
+    if (i % 4 == 1) {
+        x = random(0, screenWidth/4);
+    }
+    else if (i % 4 == 2) {
+        x = random(screenWidth/4, screenWidth/2);
+    }
+    else if (i % 4 == 3) {
+        x = random(screenWidth/2, (int) (0.625* screenWidth));
+    }
+    else {
+        x = random((int)(0.625 * screenWidth), (int)(0.75 * screenWidth));
+    }
+
+    if (i % 4 == 1 || i % 4 == 3) {
+        width = random(100, screenWidth / 2);
+    }
+    else {
+        width = random(100, screenWidth / 4);
+    }
+    mLayoutIndex++;
+}
@@ -1,10 +1,19 @@
 #include "App.hpp"
 #include "Constants.hpp"
+#include <cstdlib>
 
-int main()
+// Usage: JumpGame [ticksPerSecond]
+int main(int argc, char* argv[])
 {
+    unsigned int tickRate = defaultTickRate;
+    if (argc > 1) {
+        auto requested = std::atoi(argv[1]);
+        if (requested > 0) {
+            tickRate = (unsigned int)requested;
+        }
+    }
     
-    App app(screenWidth,screenHeight);
+    App app(screenWidth,screenHeight,tickRate);
     app.run();
 
     return 0;